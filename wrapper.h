@@ -1 +1,3 @@
+#include "include/libmp4/libmp4.h"
+#include "include/pdraw/pdraw.h"
 #include "include/pdraw_vsink/pdraw_vsink.h"